@@ -20,13 +20,14 @@
 #include <BeastConfig.h>
 #include <trackable/basics/mulDiv.h>
 #include <trackable/beast/unit_test.h>
+#include <trackable/beast/xor_shift_engine.h>
 
 namespace trackable {
 namespace test {
 
 struct mulDiv_test : beast::unit_test::suite
 {
-    void run()
+    void testExamples()
     {
         const auto max = std::numeric_limits<std::uint64_t>::max();
         const std::uint64_t max32 = std::numeric_limits<std::uint32_t>::max();
@@ -54,6 +55,52 @@ struct mulDiv_test : beast::unit_test::suite
         result = mulDiv(max - 1, max - 2, 5);
         BEAST_EXPECT(!result.first && result.second == max);
     }
+
+    // Compare against native 128-bit arithmetic on random operands so
+    // that any faster implementation must stay bit-identical.
+    void testRandom()
+    {
+#ifdef __SIZEOF_INT128__
+        using uint128 = unsigned __int128;
+        const auto max = std::numeric_limits<std::uint64_t>::max();
+
+        beast::xor_shift_engine g(19207813);
+
+        // Shift operands by a random amount so that small values,
+        // large values and overflow are all exercised.
+        auto rand = [&g]()
+        {
+            return g() >> (g() % 64);
+        };
+
+        for (int i = 0; i < 100000; ++i)
+        {
+            auto const value = rand();
+            auto const mul = rand();
+            auto div = rand();
+            if (div == 0)
+                div = 1;
+
+            uint128 const expect = uint128(value) * mul / div;
+            auto const result = mulDiv(value, mul, div);
+            if (expect > max)
+            {
+                BEAST_EXPECT(!result.first && result.second == max);
+            }
+            else
+            {
+                BEAST_EXPECT(result.first &&
+                    result.second == static_cast<std::uint64_t>(expect));
+            }
+        }
+#endif
+    }
+
+    void run()
+    {
+        testExamples();
+        testRandom();
+    }
 };
 
 BEAST_DEFINE_TESTSUITE(mulDiv, trackable_basics, trackable);